@@ -1,5 +1,142 @@
 #include "draw.hpp"
 #include "script.h"
+#include <algorithm>
+#include <cmath>
+
+#ifdef min
+#undef min
+#endif
+#ifdef max
+#undef max
+#endif
+
+static const float kRectEpsilon = 0.0001f;
+
+static inline bool NearlyEqual(float a, float b) {
+    return std::fabs(a - b) <= kRectEpsilon;
+}
+
+static inline bool SameColour(const RectCommand& a, const RectCommand& b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static inline bool RectsOverlap(const RectCommand& a, const RectCommand& b) {
+    return std::fabs(a.x - b.x) * 2 < a.w + b.w - kRectEpsilon &&
+        std::fabs(a.y - b.y) * 2 < a.h + b.h - kRectEpsilon;
+}
+
+// Merges `b` into `a` when both share an edge span and touch or overlap along
+// the other axis, so the union is still a single rect.
+static bool MergeRects(RectCommand& a, const RectCommand& b) {
+    if (!SameColour(a, b)) return false;
+
+    if (NearlyEqual(a.x, b.x) && NearlyEqual(a.w, b.w)) {
+        float top = std::min(a.y - a.h / 2, b.y - b.h / 2);
+        float bottom = std::max(a.y + a.h / 2, b.y + b.h / 2);
+        if (bottom - top > a.h + b.h + kRectEpsilon) return false;
+        a.y = (top + bottom) / 2;
+        a.h = bottom - top;
+        return true;
+    }
+    if (NearlyEqual(a.y, b.y) && NearlyEqual(a.h, b.h)) {
+        float left = std::min(a.x - a.w / 2, b.x - b.w / 2);
+        float right = std::max(a.x + a.w / 2, b.x + b.w / 2);
+        if (right - left > a.w + b.w + kRectEpsilon) return false;
+        a.x = (left + right) / 2;
+        a.w = right - left;
+        return true;
+    }
+    return false;
+}
+
+static inline int TextStateOrder(const TextCommand& a, const TextCommand& b) {
+    if (a.font != b.font) return a.font < b.font ? -1 : 1;
+    if (a.scale != b.scale) return a.scale < b.scale ? -1 : 1;
+    if (a.align != b.align) return a.align < b.align ? -1 : 1;
+    if (a.outline != b.outline) return a.outline < b.outline ? -1 : 1;
+    unsigned ca = ((unsigned)a.r << 24) | ((unsigned)a.g << 16) | ((unsigned)a.b << 8) | (unsigned)a.a;
+    unsigned cb = ((unsigned)b.r << 24) | ((unsigned)b.g << 16) | ((unsigned)b.b << 8) | (unsigned)b.a;
+    if (ca != cb) return ca < cb ? -1 : 1;
+    return 0;
+}
+
+void DrawList::Clear() {
+    rects.clear();
+    texts.clear();
+}
+
+bool DrawList::TryMergeRect(const RectCommand& rc) {
+    // Walk back through earlier rects; `rc` can only be folded into one of
+    // them if nothing drawn in between overlaps it.
+    for (int i = (int)rects.size() - 1; i >= 0; --i) {
+        if (MergeRects(rects[i], rc)) return true;
+        if (RectsOverlap(rects[i], rc)) return false;
+    }
+    return false;
+}
+
+void DrawList::Rect(float x, float y, float w, float h,
+    int r, int g, int b, int a) {
+    if (a <= 0 || w <= 0.0f || h <= 0.0f) return;
+    RectCommand rc{ x, y, w, h, r, g, b, a };
+    if (!TryMergeRect(rc)) rects.push_back(rc);
+}
+
+void DrawList::Text(float x, float y, float scale, int font, TextAlign align,
+    const std::string& text,
+    int r, int g, int b, int a,
+    bool outline, float wrapRight) {
+    if (a <= 0 || text.empty()) return;
+    texts.push_back({ x, y, scale, font, align, wrapRight, outline, r, g, b, a, text });
+}
+
+void DrawList::Append(const DrawList& other) {
+    for (const auto& rc : other.rects) {
+        if (!TryMergeRect(rc)) rects.push_back(rc);
+    }
+    texts.insert(texts.end(), other.texts.begin(), other.texts.end());
+}
+
+void DrawList::Submit() {
+    for (const auto& rc : rects) {
+        GRAPHICS::DRAW_RECT(rc.x, rc.y, rc.w, rc.h, rc.r, rc.g, rc.b, rc.a);
+    }
+
+    // Text state is reset by the game after every _DRAW_TEXT, so it is still
+    // applied per command; grouping keeps identical state back to back.
+    std::stable_sort(texts.begin(), texts.end(),
+        [](const TextCommand& a, const TextCommand& b) { return TextStateOrder(a, b) < 0; });
+
+    for (const auto& tc : texts) {
+        UI::SET_TEXT_FONT(tc.font);
+        UI::SET_TEXT_SCALE(tc.scale, tc.scale);
+        UI::SET_TEXT_COLOUR(tc.r, tc.g, tc.b, tc.a);
+        switch (tc.align) {
+        case TextAlign::Centre:
+            UI::SET_TEXT_CENTRE(true);
+            break;
+        case TextAlign::Right:
+            UI::SET_TEXT_RIGHT_JUSTIFY(true);
+            UI::SET_TEXT_WRAP(0.0f, tc.wrapRight);
+            break;
+        default:
+            UI::SET_TEXT_CENTRE(false);
+            break;
+        }
+        if (tc.outline) UI::SET_TEXT_OUTLINE();
+        UI::_SET_TEXT_ENTRY((char*)"STRING");
+        UI::_ADD_TEXT_COMPONENT_STRING(const_cast<char*>(tc.text.c_str()));
+        UI::_DRAW_TEXT(tc.x, tc.y);
+    }
+}
+
+bool CachedDrawList::NeedsRebuild(const std::array<float, 8>& inputs) {
+    if (valid && inputs == key) return false;
+    key = inputs;
+    valid = true;
+    list.Clear();
+    return true;
+}
 
 void NebulaDrawRect(float x, float y, float w, float h,
     int r, int g, int b, int a) {
@@ -63,30 +200,25 @@ void DrawSprite(const char* textureDict, const char* textureName,
 }
 
 void DrawBanner(float x, float y, float w, float h) {
-    DrawRect(x, y, w, h, 15, 15, 15, 240);
+    DrawList list;
+    BuildBanner(list, x, y, w, h);
+    list.Submit();
+}
+
+void BuildBanner(DrawList& list, float x, float y, float w, float h) {
+    list.Rect(x, y, w, h, 15, 15, 15, 240);
 
-    DrawRect(x, y - h / 2 + 0.001f, w, 0.002f, 255, 255, 255, 100);
+    list.Rect(x, y - h / 2 + 0.001f, w, 0.002f, 255, 255, 255, 100);
 
-    DrawRect(x, y + h / 2 - 0.001f, w, 0.002f, 255, 255, 255, 100);
+    list.Rect(x, y + h / 2 - 0.001f, w, 0.002f, 255, 255, 255, 100);
 
     // Title text
-    UI::SET_TEXT_FONT(1);
-    UI::SET_TEXT_SCALE(0.8f, 0.8f);
-    UI::SET_TEXT_COLOUR(255, 255, 255, 255);
-    UI::SET_TEXT_CENTRE(true);
-    UI::SET_TEXT_OUTLINE();
-    UI::_SET_TEXT_ENTRY((char*)"STRING");
-    UI::_ADD_TEXT_COMPONENT_STRING((char*)"NEBULA");
-    UI::_DRAW_TEXT(x, y - 0.025f);
+    list.Text(x, y - 0.025f, 0.8f, 1, TextAlign::Centre, "NEBULA",
+        255, 255, 255, 255, true);
 
     // Version text
-    UI::SET_TEXT_FONT(4);
-    UI::SET_TEXT_SCALE(0.28f, 0.28f);
-    UI::SET_TEXT_COLOUR(200, 200, 200, 255);
-    UI::SET_TEXT_CENTRE(true);
-    UI::_SET_TEXT_ENTRY((char*)"STRING");
-    UI::_ADD_TEXT_COMPONENT_STRING((char*)"VERSION 0.0.1");
-    UI::_DRAW_TEXT(x, y + 0.01f);
+    list.Text(x, y + 0.01f, 0.28f, 4, TextAlign::Centre, "VERSION 0.0.1",
+        200, 200, 200, 255);
 }
 
 void DrawNotification(const std::string& text) {
@@ -1,5 +1,63 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <array>
+
+enum class TextAlign {
+    Left,
+    Centre,
+    Right
+};
+
+struct RectCommand {
+    float x, y, w, h;
+    int r, g, b, a;
+};
+
+struct TextCommand {
+    float x, y;
+    float scale;
+    int font;
+    TextAlign align;
+    float wrapRight;
+    bool outline;
+    int r, g, b, a;
+    std::string text;
+};
+
+// Per-frame list of draw commands. Rects are coalesced as they are added and
+// always submitted before text; text is grouped by identical state on submit.
+class DrawList {
+private:
+    std::vector<RectCommand> rects;
+    std::vector<TextCommand> texts;
+
+    bool TryMergeRect(const RectCommand& rc);
+
+public:
+    void Clear();
+    bool Empty() const { return rects.empty() && texts.empty(); }
+
+    void Rect(float x, float y, float w, float h,
+        int r, int g, int b, int a);
+    void Text(float x, float y, float scale, int font, TextAlign align,
+        const std::string& text,
+        int r, int g, int b, int a,
+        bool outline = false, float wrapRight = 1.0f);
+
+    void Append(const DrawList& other);
+    void Submit();
+};
+
+// Command sub-list that is only rebuilt when its inputs change.
+struct CachedDrawList {
+    std::array<float, 8> key{};
+    bool valid = false;
+    DrawList list;
+
+    // Returns true if the caller has to rebuild `list` for the given inputs.
+    bool NeedsRebuild(const std::array<float, 8>& inputs);
+};
 
 void NebulaDrawRect(float x, float y, float w, float h,
     int r, int g, int b, int a);
@@ -24,6 +82,7 @@ void DrawSprite(const char* textureDict, const char* textureName,
     int r, int g, int b, int a);
 
 void DrawBanner(float x, float y, float w, float h);
+void BuildBanner(DrawList& list, float x, float y, float w, float h);
 
 void DrawNotification(const std::string& text);
 
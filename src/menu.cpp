@@ -119,11 +119,14 @@ int Menu::indexInSelectableList(int absoluteIndex) const {
     return rank;
 }
 
-void Menu::DrawHeader() {
+void Menu::DrawHeader(DrawList& list) {
     float x = style.x;
     float y = style.y;
 
-    DrawBanner(x, y, style.width, style.headerHeight);
+    if (bannerCache.NeedsRebuild({ x, y, style.width, style.headerHeight })) {
+        BuildBanner(bannerCache.list, x, y, style.width, style.headerHeight);
+    }
+    list.Append(bannerCache.list);
 
     int totalSel = selectableCount();
     int selOrd = -1;
@@ -135,17 +138,12 @@ void Menu::DrawHeader() {
     if (totalSel > 0 && selOrd >= 0) snprintf(counter, sizeof(counter), "%d/%d", selOrd + 1, totalSel);
     else snprintf(counter, sizeof(counter), "-/-");
 
-    UI::SET_TEXT_FONT(4);
-    UI::SET_TEXT_SCALE(0.35f, 0.35f);
-    UI::SET_TEXT_COLOUR(200, 200, 200, 255);
-    UI::SET_TEXT_RIGHT_JUSTIFY(true);
-    UI::SET_TEXT_WRAP(0.0f, x + style.width / 2 - 0.005f);
-    UI::_SET_TEXT_ENTRY((char*)"STRING");
-    UI::_ADD_TEXT_COMPONENT_STRING(counter);
-    UI::_DRAW_TEXT(x + style.width / 2 - 0.005f, y + style.headerHeight / 2 - 0.025f);
+    float rightX = x + style.width / 2 - 0.005f;
+    list.Text(rightX, y + style.headerHeight / 2 - 0.025f, 0.35f, 4, TextAlign::Right, counter,
+        200, 200, 200, 255, false, rightX);
 }
 
-void Menu::DrawSelection() {
+void Menu::DrawSelection(DrawList& list) {
     if (items.empty()) return;
     if (!isSelectable(items[selected])) return;
 
@@ -155,11 +153,11 @@ void Menu::DrawSelection() {
     float x = style.x;
     float y = style.y + style.headerHeight / 2 + style.listTopGap + visibleIndex * style.itemHeight;
 
-    DrawRect(x, y + style.itemHeight / 2, style.width, style.itemHeight,
+    list.Rect(x, y + style.itemHeight / 2, style.width, style.itemHeight,
         style.selection.r, style.selection.g, style.selection.b, style.selection.a);
 }
 
-void Menu::DrawItems() {
+void Menu::DrawItems(DrawList& list) {
     float x = style.x;
     float startY = style.y + style.headerHeight / 2 + style.listTopGap;
 
@@ -178,33 +176,18 @@ void Menu::DrawItems() {
         int ta = isSelectedRow ? style.selectedText.a : style.text.a;
 
         if (item.type == MenuItemType::Separator) {
-            UI::SET_TEXT_FONT(4);
-            UI::SET_TEXT_SCALE(0.33f, 0.33f);
-            UI::SET_TEXT_COLOUR(style.disabledText.r, style.disabledText.g, style.disabledText.b, style.disabledText.a);
-            UI::SET_TEXT_CENTRE(true);
-            UI::_SET_TEXT_ENTRY((char*)"STRING");
-            UI::_ADD_TEXT_COMPONENT_STRING(const_cast<char*>(item.label.c_str()));
-            UI::_DRAW_TEXT(x, itemY + style.itemHeight * 0.35f);
+            list.Text(x, itemY + style.itemHeight * 0.35f, 0.33f, 4, TextAlign::Centre, item.label,
+                style.disabledText.r, style.disabledText.g, style.disabledText.b, style.disabledText.a);
             continue;
         }
         if (item.type == MenuItemType::TextOption) {
-            UI::SET_TEXT_FONT(4);
-            UI::SET_TEXT_SCALE(0.33f, 0.33f);
-            UI::SET_TEXT_COLOUR(style.disabledText.r, style.disabledText.g, style.disabledText.b, style.disabledText.a);
-            UI::SET_TEXT_CENTRE(false);
-            UI::_SET_TEXT_ENTRY((char*)"STRING");
-            UI::_ADD_TEXT_COMPONENT_STRING(const_cast<char*>(item.label.c_str()));
-            UI::_DRAW_TEXT(x - style.width / 2 + 0.005f, itemY);
+            list.Text(x - style.width / 2 + 0.005f, itemY, 0.33f, 4, TextAlign::Left, item.label,
+                style.disabledText.r, style.disabledText.g, style.disabledText.b, style.disabledText.a);
             continue;
         }
 
-        UI::SET_TEXT_FONT(4);
-        UI::SET_TEXT_SCALE(0.35f, 0.35f);
-        UI::SET_TEXT_COLOUR(tr, tg, tb, ta);
-        UI::SET_TEXT_CENTRE(false);
-        UI::_SET_TEXT_ENTRY((char*)"STRING");
-        UI::_ADD_TEXT_COMPONENT_STRING(const_cast<char*>(item.label.c_str()));
-        UI::_DRAW_TEXT(x - style.width / 2 + 0.005f, itemY);
+        list.Text(x - style.width / 2 + 0.005f, itemY, 0.35f, 4, TextAlign::Left, item.label,
+            tr, tg, tb, ta);
 
         float rightX = x + style.width / 2 - 0.005f;
 
@@ -215,26 +198,14 @@ void Menu::DrawItems() {
                 int sr = *item.toggleState ? style.toggleOn.r : style.toggleOff.r;
                 int sg = *item.toggleState ? style.toggleOn.g : style.toggleOff.g;
                 int sb = *item.toggleState ? style.toggleOn.b : style.toggleOff.b;
-                UI::SET_TEXT_FONT(4);
-                UI::SET_TEXT_SCALE(0.35f, 0.35f);
-                UI::SET_TEXT_COLOUR(sr, sg, sb, 255);
-                UI::SET_TEXT_RIGHT_JUSTIFY(true);
-                UI::SET_TEXT_WRAP(0.0f, rightX);
-                UI::_SET_TEXT_ENTRY((char*)"STRING");
-                UI::_ADD_TEXT_COMPONENT_STRING((char*)state);
-                UI::_DRAW_TEXT(rightX, itemY);
+                list.Text(rightX, itemY, 0.35f, 4, TextAlign::Right, state,
+                    sr, sg, sb, 255, false, rightX);
             }
             break;
         }
         case MenuItemType::Submenu: {
-            UI::SET_TEXT_FONT(4);
-            UI::SET_TEXT_SCALE(0.35f, 0.35f);
-            UI::SET_TEXT_COLOUR(tr, tg, tb, ta);
-            UI::SET_TEXT_RIGHT_JUSTIFY(true);
-            UI::SET_TEXT_WRAP(0.0f, rightX);
-            UI::_SET_TEXT_ENTRY((char*)"STRING");
-            UI::_ADD_TEXT_COMPONENT_STRING((char*)">");
-            UI::_DRAW_TEXT(rightX, itemY);
+            list.Text(rightX, itemY, 0.35f, 4, TextAlign::Right, ">",
+                tr, tg, tb, ta, false, rightX);
             break;
         }
         case MenuItemType::NumberOption: {
@@ -242,14 +213,8 @@ void Menu::DrawItems() {
             if (item.isFloat && item.floatValue) ss << std::fixed << std::setprecision(1) << *item.floatValue;
             else if (item.intValue)             ss << *item.intValue;
             std::string valueStr = "< " + ss.str() + " >";
-            UI::SET_TEXT_FONT(4);
-            UI::SET_TEXT_SCALE(0.35f, 0.35f);
-            UI::SET_TEXT_COLOUR(tr, tg, tb, ta);
-            UI::SET_TEXT_RIGHT_JUSTIFY(true);
-            UI::SET_TEXT_WRAP(0.0f, rightX);
-            UI::_SET_TEXT_ENTRY((char*)"STRING");
-            UI::_ADD_TEXT_COMPONENT_STRING(const_cast<char*>(valueStr.c_str()));
-            UI::_DRAW_TEXT(rightX, itemY);
+            list.Text(rightX, itemY, 0.35f, 4, TextAlign::Right, valueStr,
+                tr, tg, tb, ta, false, rightX);
             break;
         }
         default:
@@ -258,50 +223,54 @@ void Menu::DrawItems() {
     }
 }
 
-void Menu::DrawFooter() {
+void Menu::DrawFooter(DrawList& list) {
     float x = style.x;
     float footerY = style.y + style.headerHeight / 2 + style.listTopGap + maxDisplay * style.itemHeight;
 
-    DrawRect(x, footerY + style.footerHeight / 2, style.width, style.footerHeight,
-        style.footer.r, style.footer.g, style.footer.b, style.footer.a);
+    if (footerCache.NeedsRebuild({ x, footerY, style.width, style.footerHeight,
+        (float)style.footer.r, (float)style.footer.g, (float)style.footer.b, (float)style.footer.a })) {
+        footerCache.list.Rect(x, footerY + style.footerHeight / 2, style.width, style.footerHeight,
+            style.footer.r, style.footer.g, style.footer.b, style.footer.a);
 
-    UI::SET_TEXT_FONT(4);
-    UI::SET_TEXT_SCALE(0.3f, 0.3f);
-    UI::SET_TEXT_COLOUR(200, 200, 200, 255);
-    UI::SET_TEXT_CENTRE(true);
-    UI::_SET_TEXT_ENTRY((char*)"STRING");
-    UI::_ADD_TEXT_COMPONENT_STRING((char*)"Navigate: ~c~UP/DOWN~s~  Select: ~c~Enter~s~  Back: ~c~Backspace");
-    UI::_DRAW_TEXT(x, footerY + 0.008f);
+        footerCache.list.Text(x, footerY + 0.008f, 0.3f, 4, TextAlign::Centre,
+            "Navigate: ~c~UP/DOWN~s~  Select: ~c~Enter~s~  Back: ~c~Backspace",
+            200, 200, 200, 255);
+    }
+    list.Append(footerCache.list);
 }
 
-void Menu::DrawScrollIndicator() {
+void Menu::DrawScrollIndicator(DrawList& list) {
     if (items.size() <= maxDisplay) return;
 
     float x = style.x + style.width / 2 + 0.005f;
     float startY = style.y + style.headerHeight / 2 + style.listTopGap;
     float scrollHeight = maxDisplay * style.itemHeight;
 
-    DrawRect(x, startY + scrollHeight / 2, 0.002f, scrollHeight, 40, 40, 40, 160);
+    list.Rect(x, startY + scrollHeight / 2, 0.002f, scrollHeight, 40, 40, 40, 160);
 
     float thumbHeight = (float)maxDisplay / items.size() * scrollHeight;
     float thumbProgress = (float)scrollOffset / (items.size() - maxDisplay);
     float thumbY = startY + thumbProgress * (scrollHeight - thumbHeight) + thumbHeight / 2;
 
-    DrawRect(x, thumbY, 0.003f, thumbHeight, 255, 255, 255, 200);
+    list.Rect(x, thumbY, 0.003f, thumbHeight, 255, 255, 255, 200);
 }
 
 void Menu::Render() {
     float bgY = style.y + style.headerHeight / 2 + style.listTopGap + (maxDisplay * style.itemHeight) / 2;
     float bgHeight = maxDisplay * style.itemHeight;
 
-    DrawRect(style.x, bgY, style.width, bgHeight,
+    frameList.Clear();
+
+    frameList.Rect(style.x, bgY, style.width, bgHeight,
         style.background.r, style.background.g, style.background.b, style.background.a);
 
-    DrawHeader();
-    DrawSelection();
-    DrawItems();
-    DrawFooter();
-    DrawScrollIndicator();
+    DrawHeader(frameList);
+    DrawSelection(frameList);
+    DrawItems(frameList);
+    DrawFooter(frameList);
+    DrawScrollIndicator(frameList);
+
+    frameList.Submit();
 }
 
 void Menu::AdjustScrollForTop() {
@@ -4,6 +4,7 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include "draw.hpp"
 
 enum class MenuItemType {
     Action,
@@ -51,11 +52,15 @@ private:
     float openAnimation = 0.0f;
     bool isOpening = false;
 
-    void DrawHeader();
-    void DrawItems();
-    void DrawFooter();
-    void DrawSelection();
-    void DrawScrollIndicator();
+    DrawList frameList;
+    CachedDrawList bannerCache;
+    CachedDrawList footerCache;
+
+    void DrawHeader(DrawList& list);
+    void DrawItems(DrawList& list);
+    void DrawFooter(DrawList& list);
+    void DrawSelection(DrawList& list);
+    void DrawScrollIndicator(DrawList& list);
 
     bool isSelectable(const MenuItem& it) const;
     int  findNextSelectable(int from, int step) const;